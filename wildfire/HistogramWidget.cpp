@@ -0,0 +1,60 @@
+#include "HistogramWidget.h"
+
+#include <QPainter>
+#include <QPainterPath>
+#include <algorithm>
+
+HistogramWidget::HistogramWidget(QWidget *parent)
+    : QWidget(parent), mBins(0), mChannels(0)
+{
+}
+
+QSize HistogramWidget::minimumSizeHint() const
+{
+    return QSize(128, 64);
+}
+
+QSize HistogramWidget::sizeHint() const
+{
+    return QSize(256, 100);
+}
+
+void HistogramWidget::setHistogram(const float *ptr, unsigned bins, unsigned channels)
+{
+    mBins = bins;
+    mChannels = channels;
+    mCounts = QVector<float>(bins*channels);
+    std::copy(ptr, ptr+bins*channels, mCounts.begin());
+    update();
+}
+
+void HistogramWidget::paintEvent(QPaintEvent * /* event */)
+{
+    QPainter painter(this);
+    painter.fillRect(rect(), QColor(32, 32, 32));
+    if (mBins<2 || mChannels==0)
+        return;
+
+    float peak = 0.0f;
+    for (int i=0; i<mCounts.size(); ++i)
+        peak = qMax(peak, mCounts[i]);
+    if (peak<=0.0f)
+        return;
+
+    static const QColor colors[4] = { QColor(255, 64, 64, 128), QColor(64, 255, 64, 128),
+                                      QColor(64, 64, 255, 128), QColor(192, 192, 192, 128) };
+    const float w = width();
+    const float h = height();
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setPen(Qt::NoPen);
+    for (unsigned c=0; c<mChannels; ++c) {
+        const float *counts = mCounts.constData() + c*mBins;
+        QPainterPath path(QPointF(0, h));
+        for (unsigned b=0; b<mBins; ++b)
+            path.lineTo(w*b/(mBins-1), h - h*counts[b]/peak);
+        path.lineTo(w, h);
+        path.closeSubpath();
+        painter.setBrush(mChannels==1 ? colors[3] : colors[c%4]);
+        painter.drawPath(path);
+    }
+}
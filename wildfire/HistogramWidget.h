@@ -0,0 +1,27 @@
+#ifndef HISTOGRAMWIDGET_H
+#define HISTOGRAMWIDGET_H
+
+#include <QWidget>
+#include <QVector>
+
+class HistogramWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit HistogramWidget(QWidget *parent = 0);
+
+    QSize minimumSizeHint() const;
+    QSize sizeHint() const;
+    void setHistogram(const float *ptr, unsigned bins, unsigned channels);
+
+protected:
+    void paintEvent(QPaintEvent *event);
+
+private:
+    QVector<float> mCounts;
+    unsigned mBins;
+    unsigned mChannels;
+};
+
+#endif // HISTOGRAMWIDGET_H
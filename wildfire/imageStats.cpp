@@ -0,0 +1,53 @@
+#include <algorithm>
+#include "imageStats.hpp"
+
+using namespace af;
+
+array intensityLevels(const unsigned bins)
+{
+    return range(bins);
+}
+
+array channelHistograms(const array &in, const unsigned bins)
+{
+    /* histogram batches over the channel dimension and returns bins x 1 x channels */
+    return moddims(histogram(in, bins, 0, 255), bins, in.dims(2)).as(f32);
+}
+
+array proxyHistograms(const array &in, const unsigned longEdge, const unsigned bins)
+{
+    dim_t longest = in.dims(0) > in.dims(1) ? in.dims(0) : in.dims(1);
+    if (longest <= (dim_t)longEdge)
+        return channelHistograms(in, bins);
+    float scale = (float)longEdge/longest;
+    dim_t odim0 = std::max<dim_t>(1, (dim_t)(in.dims(0)*scale));
+    dim_t odim1 = std::max<dim_t>(1, (dim_t)(in.dims(1)*scale));
+    /* nearest neighbour keeps the sampled pixel values intact */
+    array proxy = resize(in, odim0, odim1, AF_INTERP_NEAREST);
+    float countScale = (float)(in.dims(0)*in.dims(1))/(odim0*odim1);
+    return channelHistograms(proxy, bins) * countScale;
+}
+
+array remapHistogram(const array &hist, const array &lut)
+{
+    if (hist.isempty())
+        return hist;
+    unsigned bins = hist.dims(0);
+    /* destination bin of each source bin, binned the same way as channelHistograms */
+    array target = max(min(floor(lut*bins/255.0f), bins-1.0), 0.0);
+    /* onehot(j, i) is set when source bin i lands in bin j */
+    array binIds = range(dim4(bins, bins), 0);
+    array onehot = (binIds == tile(moddims(target, 1, bins), bins)).as(f32);
+    return matmul(onehot, hist);
+}
+
+array histogramStats(const array &hist)
+{
+    unsigned bins     = hist.dims(0);
+    array levels      = tile(intensityLevels(bins), 1, hist.dims(1));
+    array present     = (hist > 0).as(f32);
+    array minValues   = min(levels + (1.0f - present)*bins, 0);
+    array maxValues   = max(levels * present, 0);
+    array meanValues  = sum(levels * hist, 0) / max(sum(hist, 0), 1.0);
+    return join(0, minValues, maxValues, meanValues);
+}
@@ -0,0 +1,45 @@
+#ifndef IMAGESTATS_HPP
+#define IMAGESTATS_HPP
+
+#include <arrayfire.h>
+
+const unsigned HISTOGRAM_BINS = 256;
+const unsigned HISTOGRAM_PROXY_EDGE = 512;
+
+/**
+ * returns the intensity levels [0, bins-1] as a column vector
+ * note: running a point operation (contrast, brightness) on this
+ *       array gives the look up table of that operation
+ * */
+af::array intensityLevels(const unsigned bins=HISTOGRAM_BINS);
+
+/**
+ * computes per channel histograms of the input image with values in range [0,255]
+ * returned array is of size bins x channels
+ * */
+af::array channelHistograms(const af::array &in, const unsigned bins=HISTOGRAM_BINS);
+
+/**
+ * same as channelHistograms but computed on a nearest neighbour proxy whose
+ * longer edge is at most longEdge, counts are scaled back to the input size
+ * note: meant for edits that are not point operations and run on every
+ *       slider tick, where an exact histogram is not worth a full pass
+ * */
+af::array proxyHistograms(const af::array &in, const unsigned longEdge=HISTOGRAM_PROXY_EDGE,
+                          const unsigned bins=HISTOGRAM_BINS);
+
+/**
+ * remaps an existing histogram through the look up table of a point operation
+ * without touching the image pixels. lut values falling outside the
+ * histogram range are clamped to the first/last bin.
+ * hist is of size bins x channels, lut is of size bins x 1
+ * */
+af::array remapHistogram(const af::array &hist, const af::array &lut);
+
+/**
+ * computes min, max & mean per channel from the histogram
+ * returned array is of size 3 x channels with rows in the order min, max, mean
+ * */
+af::array histogramStats(const af::array &hist);
+
+#endif // IMAGESTATS_HPP
@@ -3,6 +3,7 @@
 #include <QMessageBox>
 #include <QFileDialog>
 #include <QDebug>
+#include <algorithm>
 
 const float UI_CONTRAST_SLIDER_MIN = 0;
 const float UI_CONTRAST_SLIDER_MAX = 99;
@@ -19,6 +20,8 @@ const float UI_USMSHARP_SLIDER_MAX = 99;
 const float USMSHARP_ALGO_MIN =  0.0f;
 const float USMSHARP_ALGO_MAX =  2.0f;
 
+const char* const CHANNEL_NAMES[4] = { "R", "G", "B", "A" };
+
 float convertRange(float value,  float dst_max, float dst_min, float src_max, float src_min)
 {
     return dst_min + (dst_max - dst_min)*((value - src_min)/(src_max-src_min));
@@ -80,6 +83,8 @@ void MainWindow::loadImage()
                                    mImageWidth,
                                    mImageHeight,
                                    mCurrentImage.dims(2));
+        mBaseHistogram = channelHistograms(mCurrentImage);
+        updateStatistics(mBaseHistogram);
     }
 }
 
@@ -100,6 +105,7 @@ void MainWindow::contrastChanged(int value)
     interleaved.host((void*)mImageDataRawPtr);
     mRenderCanvas->updateTexData(mImageDataRawPtr, mImageWidth, mImageHeight);
     mRenderCanvas->updateGL();
+    updateStatistics(remapHistogram(mBaseHistogram, changeContrast(intensityLevels(), param)));
 }
 
 void MainWindow::brightnessChanged(int value)
@@ -111,6 +117,7 @@ void MainWindow::brightnessChanged(int value)
     interleaved.host((void*)mImageDataRawPtr);
     mRenderCanvas->updateTexData(mImageDataRawPtr, mImageWidth, mImageHeight);
     mRenderCanvas->updateGL();
+    updateStatistics(remapHistogram(mBaseHistogram, changeBrightness(intensityLevels(), param)));
 }
 
 void MainWindow::usmRadiusChanged(int value)
@@ -121,6 +128,7 @@ void MainWindow::usmRadiusChanged(int value)
     interleaved.host((void*)mImageDataRawPtr);
     mRenderCanvas->updateTexData(mImageDataRawPtr, mImageWidth, mImageHeight);
     mRenderCanvas->updateGL();
+    updateStatistics(proxyHistograms(slices));
 }
 
 void MainWindow::usmChanged(int value)
@@ -132,6 +140,7 @@ void MainWindow::usmChanged(int value)
     interleaved.host((void*)mImageDataRawPtr);
     mRenderCanvas->updateTexData(mImageDataRawPtr, mImageWidth, mImageHeight);
     mRenderCanvas->updateGL();
+    updateStatistics(proxyHistograms(slices));
 }
 
 void MainWindow::zoomParamsChanged()
@@ -145,6 +154,7 @@ void MainWindow::zoomParamsChanged()
     interleaved.host((void*)mImageDataRawPtr);
     mRenderCanvas->updateTexData(mImageDataRawPtr, mImageWidth, mImageHeight);
     mRenderCanvas->updateGL();
+    updateStatistics(proxyHistograms(slices));
 }
 
 void MainWindow::zoomReset()
@@ -153,6 +163,7 @@ void MainWindow::zoomReset()
     interleaved.host((void*)mImageDataRawPtr);
     mRenderCanvas->updateTexData(mImageDataRawPtr, mImageWidth, mImageHeight);
     mRenderCanvas->updateGL();
+    updateStatistics(mBaseHistogram);
 }
 
 void MainWindow::setBackgroundImageForBlend()
@@ -201,6 +212,7 @@ void MainWindow::showBackground()
                                    mBg4Blend.dims(0),
                                    mBg4Blend.dims(2));
         mRenderCanvas->updateGL();
+        updateStatistics(proxyHistograms(mBg4Blend));
     }
 }
 
@@ -220,6 +232,7 @@ void MainWindow::showForeground()
                                    mFg4Blend.dims(0),
                                    mFg4Blend.dims(2));
         mRenderCanvas->updateGL();
+        updateStatistics(proxyHistograms(mFg4Blend));
     }
 }
 
@@ -239,6 +252,7 @@ void MainWindow::showMask()
                                    mMsk4Blend.dims(0),
                                    mMsk4Blend.dims(2));
         mRenderCanvas->updateGL();
+        updateStatistics(proxyHistograms(mMsk4Blend));
     }
 }
 
@@ -264,11 +278,43 @@ void MainWindow::showBlendedImage()
                                    mBg4Blend.dims(0),
                                    mBg4Blend.dims(2));
         mRenderCanvas->updateGL();
+        updateStatistics(proxyHistograms(slices));
     } else {
         QMessageBox::warning(this, "Invalid Input Warning", "Dimensions of the background, foreground and mask images do not match please check.");
     }
 }
 
+void MainWindow::updateStatistics(const af::array &hist)
+{
+    if (hist.isempty())
+        return;
+    unsigned bins     = hist.dims(0);
+    unsigned channels = hist.dims(1);
+    /* only the histogram and its summary leave the device */
+    const unsigned rows = bins + 3;
+    QVector<float> packed(rows*channels);
+    af::join(0, hist, histogramStats(hist)).host((void*)packed.data());
+    /* split the column major buffer into histogram counts and min, max, mean */
+    QVector<float> counts(bins*channels);
+    QVector<float> stats(3*channels);
+    for (unsigned c=0; c<channels; ++c) {
+        std::copy(packed.constBegin()+c*rows, packed.constBegin()+c*rows+bins,
+                  counts.begin()+c*bins);
+        std::copy(packed.constBegin()+c*rows+bins, packed.constBegin()+(c+1)*rows,
+                  stats.begin()+3*c);
+    }
+    ui->histogramWidget->setHistogram(counts.constData(), bins, channels);
+    QStringList lines;
+    for (unsigned c=0; c<channels; ++c) {
+        lines << QString("%1  min %2  max %3  mean %4")
+                 .arg(channels==1 ? "L" : CHANNEL_NAMES[c%4])
+                 .arg(stats[3*c+0], 0, 'f', 0)
+                 .arg(stats[3*c+1], 0, 'f', 0)
+                 .arg(stats[3*c+2], 0, 'f', 1);
+    }
+    ui->statsLabel->setText(lines.join("\n"));
+}
+
 MainWindow::~MainWindow()
 {
     af::deviceGC();
@@ -4,6 +4,7 @@
 #include <QMainWindow>
 #include "ImageCanvas.h"
 #include "imageEdit.hpp"
+#include "imageStats.hpp"
 
 Q_DECLARE_METATYPE(af::array)
 
@@ -39,6 +40,8 @@ public slots:
     void showBlendedImage(void);
 
 private:
+    void updateStatistics(const af::array &hist);
+
     Ui::MainWindow *ui;
 
     ImageCanvas *mRenderCanvas;
@@ -47,6 +50,8 @@ private:
     unsigned mImageWidth;
     unsigned mImageHeight;
     int arrayRegisterId;
+    /* histogram of the unedited image, point ops remap it instead of the pixels */
+    af::array mBaseHistogram;
     /* processing algorithm transient variables */
     int mCurrUSMRadius;
     float mCurrUSMSharpness;
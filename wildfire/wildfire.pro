@@ -22,10 +22,14 @@ LIBS += -L$${AF_PATH}/lib -laf -lforge
 SOURCES += main.cpp\
         mainwindow.cpp \
     ImageCanvas.cpp \
-    imageEdit.cpp
+    imageEdit.cpp \
+    imageStats.cpp \
+    HistogramWidget.cpp
 
 HEADERS  += mainwindow.h \
     ImageCanvas.h \
-    imageEdit.hpp
+    imageEdit.hpp \
+    imageStats.hpp \
+    HistogramWidget.h
 
 FORMS    += mainwindow.ui